@@ -0,0 +1,184 @@
+/**
+ * @brief
+ *     numberConv 의 parse / format 을 std::from_chars / std::to_chars 와 비교하는 벤치마크
+ *     각 항목은 먼저 두 결과가 같은지 확인한 뒤, 여러 번 반복한 시간 중 최솟값과 중앙값을 출력한다.
+ *
+ *     g++ -std=c++17 -O2 bench/numberConv_bench.cpp -o numberConv_bench && ./numberConv_bench [개수]
+ */
+#include "../numberConv.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr int REPEAT = 9;
+
+    volatile unsigned long long gSink{ };
+
+    struct Timing {
+        double best;
+        double median;
+    };
+
+    template <typename F>
+    Timing measure(F&& func) {
+        double samples[REPEAT];
+
+        for (double& sample : samples) {
+            const auto begin = std::chrono::steady_clock::now();
+            func();
+            sample = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        }
+
+        std::sort(samples, samples + REPEAT);
+
+        return { samples[0], samples[REPEAT / 2] };
+    }
+
+    void report(const char* name, const Timing& ours, const Timing& reference) {
+        std::printf("%-16s numberConv %8.2f ms (median %8.2f)   std %8.2f ms (median %8.2f)   ratio %.2f\n",
+                    name, ours.best, ours.median, reference.best, reference.median, ours.best / reference.best);
+    }
+
+    template <typename T>
+    std::vector<T> randomFloats(std::mt19937_64& rng, const size_t& count) {
+        using Bits = typename numberConvBase::FloatTraits<T>::bits;
+
+        std::vector<T> values;
+        values.reserve(count);
+
+        while (values.size() < count) {
+            const Bits bits = Bits(rng());
+            T value;
+            std::memcpy(&value, &bits, sizeof(T));
+
+            if (value - value == 0)     // 유한한 값만 사용
+                values.push_back(value);
+        }
+
+        return values;
+    }
+
+    template <typename T>
+    std::vector<T> randomIntegers(std::mt19937_64& rng, const size_t& count) {
+        std::vector<T> values(count);
+
+        // 자리수가 고르게 분포하도록 무작위 비트 수만큼 남긴다.
+        for (T& value : values)
+            value = T(rng() >> (rng() % 64));
+
+        return values;
+    }
+
+    template <typename T>
+    std::vector<std::string> toStrings(const std::vector<T>& values) {
+        std::vector<std::string> strings;
+        strings.reserve(values.size());
+
+        char buffer[64];
+
+        for (const T& value : values)
+            strings.emplace_back(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+
+        return strings;
+    }
+
+    template <typename T>
+    bool benchFormat(const char* name, const std::vector<T>& values) {
+        char ours[64];
+        char reference[64];
+
+        for (const T& value : values) {
+            const char*      oursEnd = numberConv::format(ours, value);
+            const char* referenceEnd = std::to_chars(reference, reference + sizeof(reference), value).ptr;
+
+            if (oursEnd - ours != referenceEnd - reference || std::memcmp(ours, reference, size_t(referenceEnd - reference)) != 0) {
+                std::printf("%-16s MISMATCH: %.*s vs %.*s\n", name, int(oursEnd - ours), ours, int(referenceEnd - reference), reference);
+                return false;
+            }
+        }
+
+        const Timing oursTime = measure([&] {
+            for (const T& value : values)
+                gSink = gSink + size_t(numberConv::format(ours, value) - ours);
+        });
+        const Timing referenceTime = measure([&] {
+            for (const T& value : values)
+                gSink = gSink + size_t(std::to_chars(reference, reference + sizeof(reference), value).ptr - reference);
+        });
+
+        report(name, oursTime, referenceTime);
+
+        return true;
+    }
+
+    template <typename T>
+    bool benchParse(const char* name, const std::vector<std::string>& strings) {
+        for (const std::string& str : strings) {
+            T ours{ }, reference{ };
+
+            const ConvResult             oursResult = numberConv::parse(str.data(), str.data() + str.size(), ours);
+            const std::from_chars_result referenceResult = std::from_chars(str.data(), str.data() + str.size(), reference);
+
+            if (oursResult.ptr != referenceResult.ptr || oursResult.error != ConvError::None || std::memcmp(&ours, &reference, sizeof(T)) != 0) {
+                std::printf("%-16s MISMATCH: %s\n", name, str.c_str());
+                return false;
+            }
+        }
+
+        const Timing oursTime = measure([&] {
+            T value{ };
+
+            for (const std::string& str : strings) {
+                numberConv::parse(str.data(), str.data() + str.size(), value);
+                gSink = gSink + (unsigned long long)(value);
+            }
+        });
+        const Timing referenceTime = measure([&] {
+            T value{ };
+
+            for (const std::string& str : strings) {
+                std::from_chars(str.data(), str.data() + str.size(), value);
+                gSink = gSink + (unsigned long long)(value);
+            }
+        });
+
+        report(name, oursTime, referenceTime);
+
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    const size_t count = (argc > 1) ? size_t(std::strtoull(argv[1], nullptr, 10)) : 1000000;
+
+    std::mt19937_64 rng(20261019);
+
+    const auto doubles  = randomFloats<double>(rng, count);
+    const auto floats   = randomFloats<float>(rng, count);
+    const auto uint64s  = randomIntegers<unsigned long long>(rng, count);
+    const auto  int64s  = randomIntegers<long long>(rng, count);
+
+    std::printf("%zu values, best of %d runs\n\n", count, REPEAT);
+
+    bool isOk = true;
+
+    isOk &= benchFormat("format double", doubles);
+    isOk &= benchFormat("format float",  floats);
+    isOk &= benchFormat("format uint64", uint64s);
+    isOk &= benchFormat("format int64",  int64s);
+
+    isOk &= benchParse<double>            ("parse double", toStrings(doubles));
+    isOk &= benchParse<float>             ("parse float",  toStrings(floats));
+    isOk &= benchParse<unsigned long long>("parse uint64", toStrings(uint64s));
+    isOk &= benchParse<long long>         ("parse int64",  toStrings(int64s));
+
+    return isOk ? 0 : 1;
+}
@@ -0,0 +1,983 @@
+#pragma once
+
+#include "./typeHandler.h"
+#include "./powerTable.h"
+
+#include <cstdlib>      // std::strtod, std::strtof (Eisel-Lemire 로 결정할 수 없는 경우에만 사용)
+
+/**
+ * @brief
+ *     숫자 변환 결과를 나타내는 에러 코드
+ */
+enum class ConvError {
+    None,               // 변환 성공
+    InvalidArgument,    // 숫자 형식이 아닌 경우
+    OutOfRange          // 타입이 표현할 수 있는 범위를 벗어난 경우
+};
+
+/**
+ * @brief
+ *     문자열 -> 숫자 변환 결과
+ *     ptr 은 변환에 사용되지 않은 첫 번째 문자를 가리킨다.
+ */
+struct ConvResult {
+    const char* ptr;
+    ConvError   error;
+};
+
+namespace numberConvBase {
+    using uint32 = unsigned int;
+    using uint64 = unsigned long long;
+    using  int64 = long long;
+
+    struct uint128 {
+        uint64 high;
+        uint64 low;
+    };
+
+    /**
+     * @brief
+     *     실수 타입별 IEEE-754 형식 정보
+     */
+    template <typename T> struct FloatTraits;
+    template <> struct FloatTraits<float> {
+        using bits = uint32;
+
+        static constexpr int SIGNIFICAND_BITS = 23;
+        static constexpr int EXPONENT_BIAS    = 150;    // value = c * 2^(e - EXPONENT_BIAS)
+        static constexpr int MINIMUM_EXPONENT = -127;
+        static constexpr int INFINITE_POWER   = 0xFF;
+
+        static constexpr int SMALLEST_POWER_OF_TEN = -65;
+        static constexpr int  LARGEST_POWER_OF_TEN =  38;
+
+        static constexpr int MIN_EXPONENT_FAST_PATH     = -10;
+        static constexpr int MAX_EXPONENT_FAST_PATH     =  10;
+        static constexpr int MIN_EXPONENT_ROUND_TO_EVEN = -17;
+        static constexpr int MAX_EXPONENT_ROUND_TO_EVEN =  10;
+
+        static constexpr uint64 MAX_MANTISSA_FAST_PATH = uint64(2) << SIGNIFICAND_BITS;
+
+        static inline float fallback(const char* str) { return std::strtof(str, nullptr); }
+    };
+    template <> struct FloatTraits<double> {
+        using bits = uint64;
+
+        static constexpr int SIGNIFICAND_BITS = 52;
+        static constexpr int EXPONENT_BIAS    = 1075;
+        static constexpr int MINIMUM_EXPONENT = -1023;
+        static constexpr int INFINITE_POWER   = 0x7FF;
+
+        static constexpr int SMALLEST_POWER_OF_TEN = -342;
+        static constexpr int  LARGEST_POWER_OF_TEN =  308;
+
+        static constexpr int MIN_EXPONENT_FAST_PATH     = -22;
+        static constexpr int MAX_EXPONENT_FAST_PATH     =  22;
+        static constexpr int MIN_EXPONENT_ROUND_TO_EVEN = -4;
+        static constexpr int MAX_EXPONENT_ROUND_TO_EVEN =  23;
+
+        static constexpr uint64 MAX_MANTISSA_FAST_PATH = uint64(2) << SIGNIFICAND_BITS;
+
+        static inline double fallback(const char* str) { return std::strtod(str, nullptr); }
+    };
+
+    inline constexpr double POW10_EXACT[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    inline constexpr char DIGIT_PAIRS[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    inline constexpr uint64 MIN_19_DIGITS = 1000000000000000000ULL;    // 10^18
+    inline constexpr uint64 MIN_20_DIGITS = 10000000000000000000ULL;   // 10^19
+
+    // 최대 유효 숫자 개수 (double 의 정확한 반올림에 필요한 767 자리 + 여유)
+    inline constexpr uint32 FALLBACK_MAX_DIGITS = 800;
+
+    /**
+     * @brief
+     *     같은 크기의 타입으로 비트 패턴을 그대로 옮긴다.
+     */
+    template <typename To, typename From>
+    inline To bitCast(const From& from) noexcept {
+        static_assert(sizeof(To) == sizeof(From));
+
+        To to;
+
+        const unsigned char* src = reinterpret_cast<const unsigned char*>(&from);
+              unsigned char* dst = reinterpret_cast<      unsigned char*>(&to);
+
+        for (uint32 i = 0; i < sizeof(To); ++i)
+            dst[i] = src[i];
+
+        return to;
+    }
+
+    #if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128Native;
+    #endif
+
+    inline uint128 multiply(const uint64& a, const uint64& b) noexcept {
+    #if defined(__SIZEOF_INT128__)
+        const uint128Native result = static_cast<uint128Native>(a) * b;
+
+        return { uint64(result >> 64), uint64(result) };
+    #else
+        const uint64 aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+        const uint64 bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+
+        const uint64 ll = aLow  * bLow;
+        const uint64 lh = aLow  * bHigh;
+        const uint64 hl = aHigh * bLow;
+        const uint64 hh = aHigh * bHigh;
+
+        const uint64 mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+
+        return { hh + (lh >> 32) + (hl >> 32) + (mid >> 32), (mid << 32) | (ll & 0xFFFFFFFF) };
+    #endif
+    }
+
+    inline int leadingZeros(uint64 value) noexcept {
+    #if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll(value);
+    #else
+        int count{ };
+
+        while (!(value & 0x8000000000000000))
+            value <<= 1, ++count;
+
+        return count;
+    #endif
+    }
+
+    inline bool isDigit(const char& ch) noexcept { return (static_cast<unsigned char>(ch - '0') < 10); }
+
+    /**
+     * @brief
+     *     8개의 문자를 little-endian 순서로 하나의 64비트 값으로 읽는다.
+     */
+    inline uint64 loadEight(const char* str) noexcept {
+        uint64 value{ };
+
+        for (uint32 i = 0; i < 8; ++i)
+            value |= uint64(static_cast<unsigned char>(str[i])) << (i * 8);
+
+        return value;
+    }
+    /**
+     * @brief
+     *     SWAR 방식으로 8개의 문자가 모두 숫자인지 한 번에 확인한다.
+     */
+    inline bool isEightDigits(const uint64& value) noexcept {
+        return (((value & 0xF0F0F0F0F0F0F0F0) | (((value + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333);
+    }
+    /**
+     * @brief
+     *     SWAR 방식으로 8자리 숫자를 곱셈 3번으로 변환한다.
+     *     value 는 isEightDigits 를 통과한 값이어야 한다.
+     */
+    inline uint32 parseEightDigits(uint64 value) noexcept {
+        constexpr uint64 MASK = 0x000000FF000000FF;
+        constexpr uint64 MUL1 = 0x000F424000000064;    // 100 + (1000000 << 32)
+        constexpr uint64 MUL2 = 0x0000271000000001;    // 1   + (10000   << 32)
+
+        value -= 0x3030303030303030;
+        value  = (value * 10) + (value >> 8);
+
+        return uint32((((value & MASK) * MUL1) + (((value >> 16) & MASK) * MUL2)) >> 32);
+    }
+
+    /**
+     * @brief
+     *     [first, last) 에서 연속된 숫자를 value 에 누적한다. (8자리씩 SWAR 처리)
+     *     자리수가 19를 넘으면 value 는 overflow 될 수 있으므로 자리수로 따로 검사해야 한다.
+     *
+     * @return const char* : 숫자가 아닌 첫 번째 문자
+     */
+    inline const char* accumulateDigits(const char* first, const char* last, uint64& value) noexcept {
+        while (last - first >= 8) {
+            const uint64 chunk = loadEight(first);
+
+            if (!isEightDigits(chunk))
+                break;
+
+            value  = value * 100000000 + parseEightDigits(chunk);
+            first += 8;
+        }
+        while (first != last && isDigit(*first))
+            value = value * 10 + uint64(*first++ - '0');
+
+        return first;
+    }
+
+    template <typename T>
+    ConvResult parseInteger(const char* first, const char* last, T& value) noexcept {
+        const char* cur = first;
+        bool isNegative = false;
+
+        if constexpr (isSigned<T>) {
+            if (cur != last && *cur == '-') {
+                isNegative = true;
+                ++cur;
+            }
+        }
+
+        const char* digitBegin = cur;
+
+        while (cur != last && *cur == '0')
+            ++cur;
+
+        const char* significantBegin = cur;
+
+        uint64 result{ };
+        cur = accumulateDigits(cur, last, result);
+
+        if (cur == digitBegin)
+            return { first, ConvError::InvalidArgument };
+
+        // 20자리 이상이면 uint64 도 넘는다. 단, 첫 자리가 1인 20자리 수는 overflow 시 10^19 미만으로 감긴다.
+        const int64 digitCount = cur - significantBegin;
+
+        if (digitCount > 20 || (digitCount == 20 && (*significantBegin != '1' || result < MIN_20_DIGITS)))
+            return { cur, ConvError::OutOfRange };
+
+        constexpr uint64 MAX_POSITIVE = isSigned<T> ? (uint64(1) << (sizeof(T) * 8 - 1)) - 1 : ~uint64(0) >> (64 - sizeof(T) * 8);
+
+        if (result > MAX_POSITIVE + uint64(isNegative))
+            return { cur, ConvError::OutOfRange };
+
+        value = isNegative ? T(0 - result) : T(result);
+
+        return { cur, ConvError::None };
+    }
+
+    inline constexpr uint64 POW10_U64[] = {
+        1ULL,                10ULL,                100ULL,                1000ULL,
+        10000ULL,            100000ULL,            1000000ULL,            10000000ULL,
+        100000000ULL,        1000000000ULL,        10000000000ULL,        100000000000ULL,
+        1000000000000ULL,    10000000000000ULL,    100000000000000ULL,    1000000000000000ULL,
+        10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+    };
+
+    /**
+     * @brief
+     *     value 의 10진수 자리수를 구한다.
+     *     log10(2) ~= 1233 / 4096 로 비트 수에서 자리수를 추정한 뒤 한 번만 보정한다.
+     */
+    inline uint32 digitCount(const uint64& value) noexcept {
+        const uint64 nonZero  = value | 1;     // 0 도 한 자리로 센다. (10^k 는 짝수이므로 비교 결과는 같다)
+        const uint32 estimate = (uint32(64 - leadingZeros(nonZero)) * 1233) >> 12;
+
+        return estimate + uint32(nonZero >= POW10_U64[estimate]);
+    }
+    /**
+     * @brief
+     *     end 바로 앞에서부터 거꾸로 value 의 숫자들을 두 자리씩 기록한다.
+     */
+    inline void writeDigits(char* end, uint64 value) noexcept {
+        while (value >= 100) {
+            const uint32 idx = uint32(value % 100) * 2;
+            value /= 100;
+
+            *--end = DIGIT_PAIRS[idx + 1];
+            *--end = DIGIT_PAIRS[idx];
+        }
+
+        if (value >= 10) {
+            *--end = DIGIT_PAIRS[value * 2 + 1];
+            *--end = DIGIT_PAIRS[value * 2];
+        }
+        else
+            *--end = char('0' + value);
+    }
+
+    template <typename T>
+    char* formatInteger(char* first, const T& value) noexcept {
+        uint64 magnitude = uint64(value);
+
+        if constexpr (isSigned<T>) {
+            if (value < 0) {
+                *first++  = '-';
+                magnitude = 0 - magnitude;
+            }
+        }
+
+        first += digitCount(magnitude);
+        writeDigits(first, magnitude);
+
+        return first;
+    }
+
+    /**
+     * @brief
+     *     w * 10^q 를 근사한 128비트 곱셈 결과를 구한다. (Eisel-Lemire)
+     *     상위 비트만으로 반올림을 결정할 수 없을 때만 5^q 의 하위 64비트까지 곱한다.
+     */
+    template <int BIT_PRECISION>
+    inline uint128 computeProductApproximation(const int64& q, const uint64& w) noexcept {
+        const int idx = 2 * int(q - POW5_MIN_EXPONENT);
+
+        uint128 first = multiply(w, POW5_128[idx]);
+
+        constexpr uint64 PRECISION_MASK = ~uint64(0) >> BIT_PRECISION;
+
+        if ((first.high & PRECISION_MASK) == PRECISION_MASK) {
+            const uint128 second = multiply(w, POW5_128[idx + 1]);
+
+            first.low += second.high;
+
+            if (second.high > first.low)
+                ++first.high;
+        }
+
+        return first;
+    }
+
+    struct AdjustedMantissa {
+        uint64 mantissa;
+        int    power2;      // biased 지수. INFINITE_POWER 이면 overflow
+
+        bool operator==(const AdjustedMantissa& other) const noexcept { return (mantissa == other.mantissa && power2 == other.power2); }
+        bool operator!=(const AdjustedMantissa& other) const noexcept { return !(*this == other); }
+    };
+
+    /**
+     * @brief
+     *     w * 10^q 에 가장 가까운 이진 실수를 구한다. (Eisel-Lemire)
+     *     w 가 10진수 19자리 이하로 정확한 값이라면 항상 올바르게 반올림된 결과를 반환한다.
+     *
+     * @tparam T float, double
+     *
+     * @param q 10진 지수
+     * @param w 10진 가수
+     *
+     * @return AdjustedMantissa : 숨김 비트를 제외한 가수와 biased 지수
+     */
+    template <typename T>
+    AdjustedMantissa computeFloat(const int64& q, uint64 w) noexcept {
+        using Traits = FloatTraits<T>;
+
+        if (w == 0 || q < Traits::SMALLEST_POWER_OF_TEN)
+            return { 0, 0 };
+        if (q > Traits::LARGEST_POWER_OF_TEN)
+            return { 0, Traits::INFINITE_POWER };
+
+        const int lz = leadingZeros(w);
+        w <<= lz;
+
+        const uint128 product = computeProductApproximation<Traits::SIGNIFICAND_BITS + 3>(q, w);
+
+        const int upperBit = int(product.high >> 63);
+        const int shift    = upperBit + 64 - Traits::SIGNIFICAND_BITS - 3;
+
+        AdjustedMantissa answer;
+        answer.mantissa = product.high >> shift;
+        answer.power2   = int((((152170 + 65536) * q) >> 16) + 63) + upperBit - lz - Traits::MINIMUM_EXPONENT;
+
+        // subnormal
+        if (answer.power2 <= 0) {
+            if (-answer.power2 + 1 >= 64)
+                return { 0, 0 };
+
+            answer.mantissa >>= -answer.power2 + 1;
+            answer.mantissa  += (answer.mantissa & 1);
+            answer.mantissa >>= 1;
+            answer.power2     = (answer.mantissa < (uint64(1) << Traits::SIGNIFICAND_BITS)) ? 0 : 1;
+
+            return answer;
+        }
+
+        // 정확히 중간값인 경우 짝수 쪽으로 반올림
+        if (product.low <= 1 && (answer.mantissa & 3) == 1 &&
+            Traits::MIN_EXPONENT_ROUND_TO_EVEN <= q && q <= Traits::MAX_EXPONENT_ROUND_TO_EVEN) {
+            if ((answer.mantissa << shift) == product.high)
+                answer.mantissa &= ~uint64(1);
+        }
+
+        answer.mantissa  += (answer.mantissa & 1);
+        answer.mantissa >>= 1;
+
+        if (answer.mantissa >= (uint64(2) << Traits::SIGNIFICAND_BITS)) {
+            answer.mantissa = (uint64(1) << Traits::SIGNIFICAND_BITS);
+            ++answer.power2;
+        }
+
+        answer.mantissa &= ~(uint64(1) << Traits::SIGNIFICAND_BITS);
+
+        if (answer.power2 >= Traits::INFINITE_POWER)
+            return { 0, Traits::INFINITE_POWER };
+
+        return answer;
+    }
+
+    template <typename T>
+    inline T toFloat(const AdjustedMantissa& am, const bool& isNegative) noexcept {
+        using Traits = FloatTraits<T>;
+        using Bits   = typename Traits::bits;
+
+        uint64 word = am.mantissa | (uint64(am.power2) << Traits::SIGNIFICAND_BITS);
+
+        if (isNegative)
+            word |= uint64(1) << (sizeof(T) * 8 - 1);
+
+        return bitCast<T>(Bits(word));
+    }
+
+    /**
+     * @brief
+     *     유효 숫자가 너무 많아 Eisel-Lemire 로 결정할 수 없는 경우, 유효 숫자를 정규화하여 C 라이브러리에 맡긴다.
+     *     "<숫자들>e<지수>" 형식으로 만들어 소수점 문자의 locale 영향을 받지 않으며, 힙 할당은 하지 않는다.
+     */
+    template <typename T>
+    T parseFallback(const char* first, const char* last, int64 exponent) noexcept {
+        char buffer[FALLBACK_MAX_DIGITS + 32];
+        uint32 length{ };
+        bool isSticky = false;
+
+        for (; first != last; ++first) {
+            if (*first == '.' || (length == 0 && *first == '0'))
+                continue;
+
+            if (length < FALLBACK_MAX_DIGITS)
+                buffer[length++] = *first;
+            else {
+                ++exponent;
+                isSticky |= (*first != '0');
+            }
+        }
+
+        // 잘려나간 숫자 중 0 이 아닌 것이 있었다면 반올림 방향만 유지하도록 1을 덧붙인다.
+        if (isSticky) {
+            buffer[length++] = '1';
+            --exponent;
+        }
+
+        buffer[length++] = 'e';
+
+        if (exponent < 0) {
+            buffer[length++] = '-';
+            exponent = -exponent;
+        }
+
+        length += digitCount(uint64(exponent));
+        writeDigits(buffer + length, uint64(exponent));
+        buffer[length] = 0;
+
+        return FloatTraits<T>::fallback(buffer);
+    }
+
+    /**
+     * @brief
+     *     "inf", "infinity", "nan" 을 대소문자 구분 없이 확인한다.
+     *
+     * @return const char* : 일치한 경우 다음 문자, 일치하지 않은 경우 nullptr
+     */
+    inline const char* matchWord(const char* first, const char* last, const char* word) noexcept {
+        for (; *word != 0; ++first, ++word) {
+            if (first == last || (*first | 0x20) != *word)
+                return nullptr;
+        }
+
+        return first;
+    }
+
+    /**
+     * @brief
+     *     "nan" 뒤에 올 수 있는 "(n-char-sequence)" 를 확인한다. n-char 는 영문자, 숫자, '_' 이다.
+     *
+     * @return const char* : 괄호까지 일치한 경우 ')' 의 다음 문자, 그 외의 경우 first
+     */
+    inline const char* matchNanPayload(const char* first, const char* last) noexcept {
+        if (first == last || *first != '(')
+            return first;
+
+        for (const char* cur = first + 1; cur != last; ++cur) {
+            if (*cur == ')')
+                return cur + 1;
+
+            const char lower = char(*cur | 0x20);
+
+            if (!isDigit(*cur) && *cur != '_' && !('a' <= lower && lower <= 'z'))
+                break;
+        }
+
+        return first;
+    }
+
+    template <typename T>
+    ConvResult parseFloat(const char* first, const char* last, T& value) noexcept {
+        using Traits = FloatTraits<T>;
+
+        const char* cur = first;
+        const bool isNegative = (cur != last && *cur == '-');
+
+        if (isNegative)
+            ++cur;
+
+        if (cur != last && !isDigit(*cur) && *cur != '.') {
+            if (const char* end = matchWord(cur, last, "inf")) {
+                if (const char* longer = matchWord(end, last, "inity"))
+                    end = longer;
+
+                value = toFloat<T>({ 0, Traits::INFINITE_POWER }, isNegative);
+
+                return { end, ConvError::None };
+            }
+            if (const char* end = matchWord(cur, last, "nan")) {
+                value = toFloat<T>({ uint64(1) << (Traits::SIGNIFICAND_BITS - 1), Traits::INFINITE_POWER }, isNegative);
+
+                return { matchNanPayload(end, last), ConvError::None };
+            }
+
+            return { first, ConvError::InvalidArgument };
+        }
+
+        const char* intBegin = cur;
+        uint64 mantissa{ };
+
+        cur = accumulateDigits(cur, last, mantissa);
+
+        const char* intEnd = cur;
+        int64 digitCount = intEnd - intBegin;
+        int64 exponent{ };
+
+        const char* fractionBegin = cur;
+        const char* fractionEnd   = cur;
+
+        if (cur != last && *cur == '.') {
+            fractionBegin = ++cur;
+            cur = fractionEnd = accumulateDigits(cur, last, mantissa);
+
+            exponent    = fractionBegin - fractionEnd;
+            digitCount -= exponent;
+        }
+
+        if (digitCount == 0)
+            return { first, ConvError::InvalidArgument };
+
+        int64 explicitExponent{ };
+
+        if (cur != last && (*cur | 0x20) == 'e') {
+            const char* expBegin = cur++;
+            bool isNegativeExp = false;
+
+            if (cur != last && (*cur == '+' || *cur == '-'))
+                isNegativeExp = (*cur++ == '-');
+
+            if (cur == last || !isDigit(*cur))
+                cur = expBegin;
+            else {
+                for (; cur != last && isDigit(*cur); ++cur) {
+                    if (explicitExponent < 0x10000)
+                        explicitExponent = explicitExponent * 10 + (*cur - '0');
+                }
+
+                if (isNegativeExp)
+                    explicitExponent = -explicitExponent;
+
+                exponent += explicitExponent;
+            }
+        }
+
+        const char* numberEnd = (fractionBegin != intEnd) ? fractionEnd : intEnd;
+        bool isTruncated = false;
+
+        // 유효 숫자가 19자리를 넘으면 앞의 19자리만으로 다시 가수를 구한다.
+        if (digitCount > 19) {
+            for (const char* p = intBegin; p != numberEnd && (*p == '0' || *p == '.'); ++p) {
+                if (*p == '0')
+                    --digitCount;
+            }
+
+            if (digitCount > 19) {
+                isTruncated = true;
+                mantissa    = 0;
+
+                const char* p = intBegin;
+
+                for (; mantissa < MIN_19_DIGITS && p != intEnd; ++p)
+                    mantissa = mantissa * 10 + uint64(*p - '0');
+
+                if (mantissa >= MIN_19_DIGITS)
+                    exponent = (intEnd - p) + explicitExponent;
+                else {
+                    for (p = fractionBegin; mantissa < MIN_19_DIGITS && p != fractionEnd; ++p)
+                        mantissa = mantissa * 10 + uint64(*p - '0');
+
+                    exponent = (fractionBegin - p) + explicitExponent;
+                }
+            }
+        }
+
+        // Clinger fast path: 가수와 10의 거듭제곱이 모두 정확히 표현되면 곱셈/나눗셈 한 번으로 끝난다.
+        if (!isTruncated && mantissa <= Traits::MAX_MANTISSA_FAST_PATH &&
+            Traits::MIN_EXPONENT_FAST_PATH <= exponent && exponent <= Traits::MAX_EXPONENT_FAST_PATH) {
+            T result = T(mantissa);
+
+            if (exponent < 0)
+                result /= T(POW10_EXACT[-exponent]);
+            else
+                result *= T(POW10_EXACT[exponent]);
+
+            value = isNegative ? -result : result;
+
+            return { cur, ConvError::None };
+        }
+
+        AdjustedMantissa am = computeFloat<T>(exponent, mantissa);
+
+        if (isTruncated && am != computeFloat<T>(exponent, mantissa + 1)) {
+            const T result = parseFallback<T>(intBegin, numberEnd, explicitExponent - (fractionEnd - fractionBegin));
+
+            am.power2   = int(bitCast<typename Traits::bits>(result) >> Traits::SIGNIFICAND_BITS);
+            am.mantissa = bitCast<typename Traits::bits>(result) & ((uint64(1) << Traits::SIGNIFICAND_BITS) - 1);
+        }
+
+        // overflow, 또는 0 이 아닌 값이 0 으로 underflow 된 경우
+        if (am.power2 == Traits::INFINITE_POWER || (am.power2 == 0 && am.mantissa == 0 && mantissa != 0))
+            return { cur, ConvError::OutOfRange };
+
+        value = toFloat<T>(am, isNegative);
+
+        return { cur, ConvError::None };
+    }
+
+    inline int floorLog2Pow10(const int& e)              noexcept { return (e * 1741647) >> 19; }
+    inline int floorLog10Pow2(const int& e)              noexcept { return (e * 1262611) >> 22; }
+    inline int floorLog10ThreeQuartersPow2(const int& e) noexcept { return (e * 1262611 - 524031) >> 22; }
+
+    /**
+     * @brief
+     *     Schubfach 에서 사용하는 10^k 의 128비트 근사값 g = floor(10^k * 2^-r) + 1 을 구한다.
+     *     10^k 의 정규화된 가수는 5^k 의 것과 같으므로 Eisel-Lemire 테이블을 그대로 사용한다.
+     */
+    inline uint128 pow10Significand(const int& k) noexcept {
+        const int idx = 2 * (k - POW5_MIN_EXPONENT);
+
+        uint128 g = { POW5_128[idx], POW5_128[idx + 1] };
+
+        // -27 <= k < 0 구간은 테이블에 이미 +1 이 되어 있다.
+        if (k < -27 || 0 <= k) {
+            if (++g.low == 0)
+                ++g.high;
+        }
+
+        return g;
+    }
+
+    inline uint64 roundToOdd(const uint128& g, const uint64& cp) noexcept {
+        const uint128 x = multiply(g.low,  cp);
+              uint128 y = multiply(g.high, cp);
+
+        y.low += x.high;
+
+        if (y.low < x.high)
+            ++y.high;
+
+        return y.high | uint64(y.low > 1);
+    }
+
+    struct Decimal {
+        uint64 significand;
+        int    exponent;
+    };
+
+    /**
+     * @brief
+     *     유한한 양수 실수를 가장 짧으면서 원래 값으로 되돌아오는 10진수로 변환한다. (Schubfach)
+     *
+     * @tparam T float, double
+     *
+     * @param ieeeSignificand IEEE-754 가수 비트
+     * @param ieeeExponent    IEEE-754 지수 비트
+     *
+     * @return Decimal : significand * 10^exponent (significand 의 끝자리 0 은 제거된 상태)
+     */
+    template <typename T>
+    Decimal toDecimal(const uint64& ieeeSignificand, const int& ieeeExponent) noexcept {
+        using Traits = FloatTraits<T>;
+
+        constexpr uint64 HIDDEN_BIT = uint64(1) << Traits::SIGNIFICAND_BITS;
+
+        uint64 c;
+        int    q;
+        Decimal result;
+
+        if (ieeeExponent != 0) {
+            c = HIDDEN_BIT | ieeeSignificand;
+            q = ieeeExponent - Traits::EXPONENT_BIAS;
+
+            // 소수부가 없는 정수값인 경우
+            if (0 <= -q && -q <= Traits::SIGNIFICAND_BITS && (c & ((uint64(1) << -q) - 1)) == 0) {
+                result = { c >> -q, 0 };
+
+                while (result.significand % 10 == 0)
+                    result.significand /= 10, ++result.exponent;
+
+                return result;
+            }
+        }
+        else {
+            c = ieeeSignificand;
+            q = 1 - Traits::EXPONENT_BIAS;
+        }
+
+        const bool isEven                = (c % 2 == 0);
+        const bool isLowerBoundaryCloser = (ieeeSignificand == 0 && ieeeExponent > 1);
+
+        const uint64 cbl = 4 * c - 2 + uint64(isLowerBoundaryCloser);
+        const uint64 cb  = 4 * c;
+        const uint64 cbr = 4 * c + 2;
+
+        const int k = isLowerBoundaryCloser ? floorLog10ThreeQuartersPow2(q) : floorLog10Pow2(q);
+        const int h = q + floorLog2Pow10(-k) + 1;
+
+        const uint128 g = pow10Significand(-k);
+
+        const uint64 vbl = roundToOdd(g, cbl << h);
+        const uint64 vb  = roundToOdd(g, cb  << h);
+        const uint64 vbr = roundToOdd(g, cbr << h);
+
+        const uint64 lower = vbl + uint64(!isEven);
+        const uint64 upper = vbr - uint64(!isEven);
+
+        const uint64 s = vb / 4;
+
+        if (s >= 10) {
+            const uint64 sp = s / 10;
+
+            const bool isUpInside = (lower <= 40 * sp);
+            const bool isWpInside = (40 * sp + 40 <= upper);
+
+            if (isUpInside != isWpInside)
+                result = { sp + uint64(isWpInside), k + 1 };
+            else
+                result = { 0, 0 };
+        }
+        else
+            result = { 0, 0 };
+
+        if (result.significand == 0) {
+            const bool isUInside = (lower <= 4 * s);
+            const bool isWInside = (4 * s + 4 <= upper);
+
+            if (isUInside != isWInside)
+                result = { isUInside ? s : s + 1, k };
+            else {
+                const uint64 mid = 4 * s + 2;
+
+                result = { (vb > mid || (vb == mid && (s & 1) != 0)) ? s + 1 : s, k };
+            }
+        }
+
+        while (result.significand % 10 == 0)
+            result.significand /= 10, ++result.exponent;
+
+        return result;
+    }
+
+    /**
+     * @brief
+     *     정수값 c * 2^q (0 < q < 64) 를 10진수로 정확히 기록한다.
+     *     고정 소수점 표기로 고른 값은 10^24 미만이므로, 10^9 단위로 나누면 최대 3 조각이 된다.
+     */
+    inline char* writeExactInteger(char* first, const uint64& c, const int& q) noexcept {
+        uint64 parts[3] = { c >> (64 - q), (c << q) >> 32, (c << q) & 0xFFFFFFFF };     // 2^32 단위
+        uint32 chunks[3];
+        int    count{ };
+
+        do {
+            uint64 remainder{ };
+
+            for (uint64& part : parts) {
+                const uint64 cur = (remainder << 32) | part;
+
+                part      = cur / 1000000000;
+                remainder = cur % 1000000000;
+            }
+
+            chunks[count++] = uint32(remainder);
+        } while (parts[0] | parts[1] | parts[2]);
+
+        first += digitCount(chunks[--count]);
+        writeDigits(first, chunks[count]);
+
+        while (count > 0) {
+            for (int i = 0; i < 9; ++i)
+                first[i] = '0';
+
+            first += 9;
+            writeDigits(first, chunks[--count]);
+        }
+
+        return first;
+    }
+
+    /**
+     * @brief
+     *     std::to_chars 의 기본 형식과 같이, 고정 소수점과 지수 표기 중 더 짧은 것으로 기록한다. (같으면 고정 소수점)
+     *     고정 소수점으로 기록하는 정수값은 가장 짧은 숫자 뒤를 0 으로 채우지 않고 c * 2^q 의 정확한 값을 기록한다.
+     *
+     * @param decimal 가장 짧은 10진수 표현
+     * @param c       이진 가수 (숨김 비트 포함)
+     * @param q       이진 지수 (value = c * 2^q)
+     */
+    inline char* writeDecimal(char* first, const Decimal& decimal, const uint64& c, const int& q) noexcept {
+        const int n = int(digitCount(decimal.significand));
+        const int k = decimal.exponent;
+        const int e = k + n - 1;
+
+        const int scientificLength = n + (n > 1 ? 1 : 0) + 2 + (e <= -100 || 100 <= e ? 3 : 2);
+        const int fixedLength      = (k >= 0) ? n + k : (-k < n) ? n + 1 : 2 - k;
+
+        if (fixedLength <= scientificLength) {
+            if (k > 0 && q > 0)
+                return writeExactInteger(first, c, q);
+
+            if (k >= 0) {
+                writeDigits(first + n, decimal.significand);
+
+                for (int i = 0; i < k; ++i)
+                    first[n + i] = '0';
+            }
+            else if (-k < n) {
+                const int intLength = n + k;
+
+                writeDigits(first + n + 1, decimal.significand);
+
+                for (int i = 0; i < intLength; ++i)
+                    first[i] = first[i + 1];
+
+                first[intLength] = '.';
+            }
+            else {
+                first[0] = '0';
+                first[1] = '.';
+
+                for (int i = 2; i < 2 - k - n; ++i)
+                    first[i] = '0';
+
+                writeDigits(first + 2 - k, decimal.significand);
+            }
+
+            return first + fixedLength;
+        }
+
+        writeDigits(first + n + 1, decimal.significand);
+        first[0] = first[1];
+
+        if (n > 1) {
+            first[1] = '.';
+            first   += n + 1;
+        }
+        else
+            first += 1;
+
+        *first++ = 'e';
+        *first++ = (e < 0) ? '-' : '+';
+
+        const uint32 absExp = uint32(e < 0 ? -e : e);
+
+        if (absExp >= 100) {
+            *first++ = char('0' + absExp / 100);
+            first[0] = DIGIT_PAIRS[(absExp % 100) * 2];
+            first[1] = DIGIT_PAIRS[(absExp % 100) * 2 + 1];
+        }
+        else {
+            first[0] = DIGIT_PAIRS[absExp * 2];
+            first[1] = DIGIT_PAIRS[absExp * 2 + 1];
+        }
+
+        return first + 2;
+    }
+
+    template <typename T>
+    char* formatFloat(char* first, const T& value) noexcept {
+        using Traits = FloatTraits<T>;
+
+        const uint64 bits = bitCast<typename Traits::bits>(value);
+
+        const uint64 ieeeSignificand = bits & ((uint64(1) << Traits::SIGNIFICAND_BITS) - 1);
+        const int    ieeeExponent    = int(bits >> Traits::SIGNIFICAND_BITS) & Traits::INFINITE_POWER;
+
+        if (bits >> (sizeof(T) * 8 - 1))
+            *first++ = '-';
+
+        if (ieeeExponent == Traits::INFINITE_POWER) {
+            const char* word = (ieeeSignificand == 0) ? "inf" : "nan";
+
+            for (uint32 i = 0; i < 3; ++i)
+                *first++ = word[i];
+
+            return first;
+        }
+        if (ieeeExponent == 0 && ieeeSignificand == 0) {
+            *first++ = '0';
+
+            return first;
+        }
+
+        const uint64 c = (ieeeExponent != 0) ? (uint64(1) << Traits::SIGNIFICAND_BITS) | ieeeSignificand : ieeeSignificand;
+        const int    q = ((ieeeExponent != 0) ? ieeeExponent : 1) - Traits::EXPONENT_BIAS;
+
+        return writeDecimal(first, toDecimal<T>(ieeeSignificand, ieeeExponent), c, q);
+    }
+}
+
+namespace numberConv {
+    // format 이 한 번에 기록할 수 있는 최대 문자 수 (null terminator 제외)
+    inline constexpr unsigned int MAX_FORMAT_LENGTH = 24;
+
+    /**
+     * @brief
+     *     [first, last) 문자열을 숫자로 변환한다. 예외를 던지지 않으며 힙 할당도 하지 않는다.
+     *     형식은 std::from_chars 와 같다. (앞의 '+', 공백 불허 / 정수는 10진수만)
+     *     변환에 실패하면 value 는 변경되지 않는다.
+     *
+     * @tparam T 정수 타입 또는 float, double
+     *
+     * @param first 문자열 시작
+     * @param last  문자열 끝
+     * @param value 변환 결과를 저장할 변수
+     *
+     * @return ConvResult : 변환되지 않은 첫 번째 문자와 에러 코드
+     */
+    template <typename T, typename = enableIF<isArithmetic<T>>>
+    ConvResult parse(const char* first, const char* last, T& value) noexcept {
+        if constexpr (isFloatingPoint<T>)
+            return numberConvBase::parseFloat(first, last, value);
+        else
+            return numberConvBase::parseInteger(first, last, value);
+    }
+
+    /**
+     * @brief
+     *     value 를 문자열로 변환하여 first 부터 기록한다. (null terminator 는 기록하지 않음)
+     *     실수는 원래 값으로 되돌아오는 가장 짧은 표현으로 기록한다.
+     *     first 에는 MAX_FORMAT_LENGTH 만큼의 공간이 있어야 한다.
+     *
+     * @tparam T 정수 타입 또는 float, double
+     *
+     * @param first 기록을 시작할 위치
+     * @param value 변환할 값
+     *
+     * @return char* : 기록된 마지막 문자의 다음 위치
+     */
+    template <typename T, typename = enableIF<isArithmetic<T>>>
+    char* format(char* first, const T& value) noexcept {
+        if constexpr (isFloatingPoint<T>)
+            return numberConvBase::formatFloat(first, value);
+        else
+            return numberConvBase::formatInteger(first, value);
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "./typeHandler.h"
+#include "./numberConv.h"
 
 /*      ! TODO LISTS
     1. 구현 못한것들 구현하기
@@ -52,6 +53,9 @@ class String {
         uint32  find(const String& str) const;
         uint32 rfind(const String& str) const;
 
+        template <typename T, typename = enableIF<isArithmetic<T>>> ConvError parse(T& value) const;
+        template <typename T, typename = enableIF<isArithmetic<T>>> ConvError append(const T& value);
+
         inline uint32   length() const;
         inline uint32 capacity() const;
         inline const char* str() const;
@@ -62,7 +66,8 @@ class String {
 
     private:
         [[nodiscard]] char*  alloc(const uint32& size) const;
-        void reAlloc(const uint32& size) const;
+        void reAlloc(const uint32& size);
+        void grow(const uint32& needSpace);
 
         inline bool isEnoughSpace(const uint32& needSpace) const;
         inline bool isValidIdx(const uint32& idx) const;
@@ -112,10 +117,8 @@ String::~String() noexcept { clear(); }
  * @return String& : 호출 객체의 참조
  */
 String& String::operator+=(const char& ch) {
-    if (!isEnoughSpace(1)) {
-        // re-allocation
-
-    }
+    if (!isEnoughSpace(1))
+        grow(1);
 
     mStr[mLength++] = ch;
     mStr[mLength]   = 0;
@@ -270,6 +273,59 @@ String String::slice(const uint32& from, const uint32& to) const {
     return String();
 }
 
+/**
+ * @brief
+ *     문자열 전체를 T 타입의 숫자로 변환한다. 예외를 던지지 않으며 힙 할당도 하지 않는다.
+ *     문자열 전체가 숫자 형식이어야 하며, 실패한 경우 value 는 변경되지 않는다.
+ *
+ * @tparam T 정수 타입 또는 float, double
+ *
+ * @param value 변환 결과를 저장할 변수
+ *
+ * @return ConvError : 변환 결과 에러 코드
+ */
+template <typename T, typename>
+ConvError String::parse(T& value) const {
+    if (isEmpty())
+        return ConvError::InvalidArgument;
+
+    T result{ };
+    const ConvResult conv = numberConv::parse(mStr, mStr + mLength, result);
+
+    if (conv.error != ConvError::None)
+        return conv.error;
+    if (conv.ptr != mStr + mLength)
+        return ConvError::InvalidArgument;
+
+    value = result;
+
+    return ConvError::None;
+}
+/**
+ * @brief
+ *     숫자를 문자열로 변환하여 문자열의 끝에 추가한다.
+ *     임시 문자열 없이 남은 공간에 바로 기록하며, 실수는 원래 값으로 되돌아오는 가장 짧은 표현으로 기록한다.
+ *
+ * @tparam T 정수 타입 또는 float, double
+ *
+ * @param value 추가할 숫자
+ *
+ * @return ConvError : 문자열 길이가 uint32 범위를 넘는 경우 OutOfRange
+ */
+template <typename T, typename>
+ConvError String::append(const T& value) {
+    if (~uint32(0) - mLength <= numberConv::MAX_FORMAT_LENGTH)
+        return ConvError::OutOfRange;
+
+    if (!isEnoughSpace(numberConv::MAX_FORMAT_LENGTH))
+        grow(numberConv::MAX_FORMAT_LENGTH);
+
+    mLength = uint32(numberConv::format(mStr + mLength, value) - mStr);
+    mStr[mLength] = 0;
+
+    return ConvError::None;
+}
+
 void String::clear() {
     delete[] mStr;
     mStr      = { };
@@ -309,6 +365,36 @@ inline String::uint32 String::length(const char* str) {
  * @return char* : 할당된 문자 배열
  */
 [[nodiscard]] char* String::alloc(const uint32& size) const { return new char[size]; }
+/**
+ * @brief
+ *     size 크기의 문자 배열을 새로 할당하고, 기존 문자열을 옮긴다.
+ *     이 때, size 는 문자열 길이보다 커야 한다.
+ *
+ * @param size 새로 할당할 문자 배열의 크기
+ */
+void String::reAlloc(const uint32& size) {
+    char* str = alloc(size);
+
+    for (uint32 i = 0; i < mLength; ++i)
+        str[i] = mStr[i];
+    str[mLength] = 0;
+
+    delete[] mStr;
+    mStr      = str;
+    mCapacity = size;
+}
+/**
+ * @brief
+ *     needSpace 만큼의 공간을 추가로 사용할 수 있도록 용량을 늘린다.
+ *     재할당 횟수를 줄이기 위해 최소 두 배씩 늘린다.
+ *
+ * @param needSpace 앞으로 필요한 공간 [Byte]
+ */
+void String::grow(const uint32& needSpace) {
+    const uint32 minCapacity = mLength + needSpace + 1;
+
+    reAlloc((mCapacity * 2 > minCapacity) ? mCapacity * 2 : minCapacity);
+}
 
 /**
  * @brief
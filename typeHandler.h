@@ -17,5 +17,25 @@ using enableIF = typename typeHandlingBase::enableIF<Condition, T>::type;
 template <typename, typename> inline constexpr bool isSame       = false;
 template <typename T>         inline constexpr bool isSame<T, T> = true;
 
+template <typename> inline constexpr bool isIntegral                     = false;
+template <>         inline constexpr bool isIntegral<char>               = true;
+template <>         inline constexpr bool isIntegral<signed char>        = true;
+template <>         inline constexpr bool isIntegral<unsigned char>      = true;
+template <>         inline constexpr bool isIntegral<short>              = true;
+template <>         inline constexpr bool isIntegral<unsigned short>     = true;
+template <>         inline constexpr bool isIntegral<int>                = true;
+template <>         inline constexpr bool isIntegral<unsigned int>       = true;
+template <>         inline constexpr bool isIntegral<long>               = true;
+template <>         inline constexpr bool isIntegral<unsigned long>      = true;
+template <>         inline constexpr bool isIntegral<long long>          = true;
+template <>         inline constexpr bool isIntegral<unsigned long long> = true;
+
+template <typename> inline constexpr bool isFloatingPoint         = false;
+template <>         inline constexpr bool isFloatingPoint<float>  = true;
+template <>         inline constexpr bool isFloatingPoint<double> = true;
+
+template <typename T> inline constexpr bool isArithmetic = isIntegral<T> || isFloatingPoint<T>;
+template <typename T> inline constexpr bool isSigned     = (T(-1) < T(0));
+
 template <typename T>
 [[nodiscard]] constexpr decltype(auto) move(T&& _val) noexcept { return static_cast<removeReference<T>&&>(_val); }
\ No newline at end of file